@@ -75,6 +75,10 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     
     // Rotation
     BOOL _rotationActive;
+    
+    // Content window
+    BOOL _loadedInContentWindow;
+    BOOL _scrollAnimationActive;
 }
 
 @property (nonatomic, readonly) BOOL itemsSubviewsCacheIsValid;
@@ -107,15 +111,24 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 - (void)recomputeSizeAnimated:(BOOL)animated;
 - (void)relayoutItemsAnimated:(BOOL)animated;
 - (NSArray *)itemSubviews;
-- (GMGridViewCell *)cellForItemAtIndex:(NSInteger)position;
+- (GMGridViewCell *)cellForItemAtPosition:(NSInteger)position;
 - (GMGridViewCell *)newItemSubViewForPosition:(NSInteger)position;
 - (NSInteger)positionForItemSubview:(GMGridViewCell *)view;
 - (void)setSubviewsCacheAsInvalid;
 - (CGRect)rectForPoint:(CGPoint)point inPaggingMode:(BOOL)pagging;
 
+// Content window
+- (BOOL)layoutUsesContentWindow;
+- (NSInteger)itemIndexForPosition:(NSInteger)position;
+- (void)recenterContentWindowIfNeeded;
+- (void)scrollPanGestureUpdated:(UIPanGestureRecognizer *)panGesture;
+- (void)shiftContentWindowByPositions:(NSInteger)positionShift offset:(CGPoint)offsetShift;
+
 // Lazy loading
 - (void)loadRequiredItems;
 - (void)cleanupUnseenItems;
+- (void)recycleLoadedItems;
+- (void)reloadLoadedItems;
 - (void)queueReusableCell:(GMGridViewCell *)cell;
 
 // Memory warning
@@ -238,6 +251,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     }
     [panGestureRecognizer setMaximumNumberOfTouches:1];
     [panGestureRecognizer requireGestureRecognizerToFail:_sortingPanGesture];
+    [panGestureRecognizer addTarget:self action:@selector(scrollPanGestureUpdated:)];
     
     self.layoutStrategy = [GMGridViewLayoutStrategyFactory strategyFromType:GMGridViewLayoutVertical];
     
@@ -291,6 +305,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 {
     [self recomputeSizeAnimated:!(animation & GMGridViewItemAnimationNone)];
     [self relayoutItemsAnimated:animation & GMGridViewItemAnimationFade]; // only supported animation for now
+    [self recenterContentWindowIfNeeded];
     [self loadRequiredItems];
 }
 
@@ -325,7 +340,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
         
         if (_transformingItem && _inFullSizeMode) 
         {
-            NSInteger position = _transformingItem.tag - kTagOffset;
+            NSInteger position = [self itemIndexForPosition:_transformingItem.tag - kTagOffset];
             CGSize fullSize = [self.transformDelegate GMGridView:self sizeInFullSizeForCell:_transformingItem atIndex:position inInterfaceOrientation:[[UIApplication sharedApplication] statusBarOrientation]];
             
             if (!CGSizeEqualToSize(fullSize, _transformingItem.fullSize)) 
@@ -395,6 +410,23 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 {
     _layoutStrategy = layoutStrategy;
     
+    BOOL usesContentWindow = [self layoutUsesContentWindow];
+    
+    // The positions of the loaded cells don't point to the same items anymore
+    if (_loadedInContentWindow || usesContentWindow) 
+    {
+        [self recycleLoadedItems];
+    }
+    
+    // The scroll indicators would only show the position inside of the content window
+    if (_loadedInContentWindow != usesContentWindow) 
+    {
+        self.showsHorizontalScrollIndicator = !usesContentWindow;
+        self.showsVerticalScrollIndicator   = !usesContentWindow;
+    }
+    
+    _loadedInContentWindow = usesContentWindow;
+    
     self.pagingEnabled = [[self.layoutStrategy class] requiresEnablingPaging];
     [self setNeedsLayout];
 }
@@ -444,7 +476,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     {
         for (GMGridViewCell *cell in [self itemSubviews]) 
         {
-            NSInteger index = [self positionForItemSubview:cell];
+            NSInteger index = [self itemIndexForPosition:[self positionForItemSubview:cell]];
             if (index != GMGV_INVALID_POSITION)
             {
                 BOOL allowEdit = editing && [self.dataSource GMGridView:self canDeleteItemAtIndex:index];
@@ -472,6 +504,26 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     }
 }
 
+- (void)setContentOffset:(CGPoint)contentOffset animated:(BOOL)animated
+{
+    // Scrolling to the top (i.e. tapping the status bar) of a content window that doesn't start with the
+    // first item only reaches the top of the window; going to the first item instead
+    BOOL scrollsToTopOfWindow = animated 
+                                && contentOffset.y <= -self.contentInset.top 
+                                && self.contentOffset.y > contentOffset.y
+                                && [self layoutUsesContentWindow] 
+                                && [self itemIndexForPosition:0] > 0;
+    
+    if (scrollsToTopOfWindow) 
+    {
+        [self scrollToObjectAtIndex:0 atScrollPosition:GMGridViewScrollPositionTop animated:YES];
+    }
+    else
+    {
+        [super setContentOffset:contentOffset animated:animated];
+    }
+}
+
 
 //////////////////////////////////////////////////////////////
 #pragma mark GestureRecognizer delegate
@@ -500,7 +552,9 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     }
     else if (gestureRecognizer == _longPressGesture)
     {
-        valid = (self.sortingDelegate || self.enableEditOnLongPress) && !isScrolling && !self.isEditing;
+        // Sorting isn't supported when positions don't match the datasource indexes
+        BOOL canSort = self.sortingDelegate && ![self layoutUsesContentWindow];
+        valid = (canSort || self.enableEditOnLongPress) && !isScrolling && !self.isEditing;
     }
     else if (gestureRecognizer == _sortingPanGesture) 
     {
@@ -705,7 +759,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 {
     NSInteger position = [self.layoutStrategy itemPositionFromLocation:point];
     
-    GMGridViewCell *item = [self cellForItemAtIndex:position];
+    GMGridViewCell *item = [self cellForItemAtPosition:position];
     
     [self bringSubviewToFront:item];
     _sortMovingItem = item;
@@ -772,8 +826,8 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 
 - (void)sortingMoveDidContinueToPoint:(CGPoint)point
 {
-    int position = [self.layoutStrategy itemPositionFromLocation:point];
-    int tag = position + kTagOffset;
+    NSInteger position = [self.layoutStrategy itemPositionFromLocation:point];
+    NSInteger tag = position + kTagOffset;
     
     if (position != GMGV_INVALID_POSITION && position != _sortFuturePosition && position < _numberTotalItems) 
     {
@@ -827,7 +881,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
                 {
                     if (_sortMovingItem) 
                     {
-                        UIView *v = [self cellForItemAtIndex:position];
+                        UIView *v = [self cellForItemAtPosition:position];
                         
                         v.tag = _sortFuturePosition + kTagOffset;
                         CGPoint origin = [self.layoutStrategy originForItemAtPosition:_sortFuturePosition];
@@ -1016,7 +1070,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     {        
         CGPoint locationTouch = [gesture locationOfTouch:0 inView:self];            
         NSInteger positionTouch = [self.layoutStrategy itemPositionFromLocation:locationTouch];
-        _transformingItem = [self cellForItemAtIndex:positionTouch];
+        _transformingItem = [self cellForItemAtPosition:positionTouch];
         
         CGRect frameInMainView = [self convertRect:_transformingItem.frame toView:self.mainSuperView];
         
@@ -1027,8 +1081,9 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
         [self.mainSuperView addSubview:_transformingItem];
         [self.mainSuperView bringSubviewToFront:_transformingItem];
         
-        _transformingItem.fullSize = [self.transformDelegate GMGridView:self sizeInFullSizeForCell:_transformingItem atIndex:positionTouch inInterfaceOrientation:[[UIApplication sharedApplication] statusBarOrientation]];
-        _transformingItem.fullSizeView = [self.transformDelegate GMGridView:self fullSizeViewForCell:_transformingItem atIndex:positionTouch];
+        NSInteger index = [self itemIndexForPosition:positionTouch];
+        _transformingItem.fullSize = [self.transformDelegate GMGridView:self sizeInFullSizeForCell:_transformingItem atIndex:index inInterfaceOrientation:[[UIApplication sharedApplication] statusBarOrientation]];
+        _transformingItem.fullSizeView = [self.transformDelegate GMGridView:self fullSizeViewForCell:_transformingItem atIndex:index];
         
         if ([self.transformDelegate respondsToSelector:@selector(GMGridView:didStartTransformingCell:)]) 
         {
@@ -1128,6 +1183,8 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
                                  [self addGestureRecognizer:_pinchGesture];
                                  [self addGestureRecognizer:_rotationGesture];
                                  [self addGestureRecognizer:_panGesture];
+                                 
+                                 [self recenterContentWindowIfNeeded];
                              }
              ];
         }
@@ -1146,8 +1203,8 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     if (position != GMGV_INVALID_POSITION) 
     {
         if (!self.editing) {
-            [self cellForItemAtIndex:position].highlighted = NO;
-            [self.actionDelegate GMGridView:self didTapOnItemAtIndex:position];
+            [self cellForItemAtPosition:position].highlighted = NO;
+            [self.actionDelegate GMGridView:self didTapOnItemAtIndex:[self itemIndexForPosition:position]];
         }
     }
     else
@@ -1174,7 +1231,8 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 
 - (GMGridViewCell *)newItemSubViewForPosition:(NSInteger)position
 {
-    GMGridViewCell *cell = [self.dataSource GMGridView:self cellForItemAtIndex:position];
+    NSInteger itemIndex = [self itemIndexForPosition:position];
+    GMGridViewCell *cell = [self.dataSource GMGridView:self cellForItemAtIndex:itemIndex];
     CGPoint origin = [self.layoutStrategy originForItemAtPosition:position];
     CGRect frame = CGRectMake(origin.x, origin.y, _itemSize.width, _itemSize.height);
     
@@ -1185,13 +1243,13 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     }];
 
     cell.tag = position + kTagOffset;
-    BOOL canEdit = self.editing && [self.dataSource GMGridView:self canDeleteItemAtIndex:position];
+    BOOL canEdit = self.editing && [self.dataSource GMGridView:self canDeleteItemAtIndex:itemIndex];
     [cell setEditing:canEdit animated:NO];
     
     __gm_weak GMGridView *weakSelf = self; 
     cell.deleteBlock = ^(GMGridViewCell *aCell)
     {
-        NSInteger index = [weakSelf positionForItemSubview:aCell];
+        NSInteger index = [weakSelf itemIndexForPosition:[weakSelf positionForItemSubview:aCell]];
         if (index != GMGV_INVALID_POSITION) 
         {
             BOOL canDelete = YES;
@@ -1222,7 +1280,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     {
         @synchronized(self)
         {
-            NSMutableArray *itemSubViews = [[NSMutableArray alloc] initWithCapacity:_numberTotalItems];
+            NSMutableArray *itemSubViews = [[NSMutableArray alloc] initWithCapacity:[[self subviews] count]];
             
             for (UIView * v in [self subviews]) 
             {
@@ -1242,7 +1300,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     return subviews;
 }
 
-- (GMGridViewCell *)cellForItemAtIndex:(NSInteger)position
+- (GMGridViewCell *)cellForItemAtPosition:(NSInteger)position
 {
     GMGridViewCell *view = nil;
     
@@ -1258,6 +1316,27 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     return view;
 }
 
+- (GMGridViewCell *)cellForItemAtIndex:(NSInteger)index
+{
+    if (![self layoutUsesContentWindow]) 
+    {
+        return [self cellForItemAtPosition:index];
+    }
+    
+    GMGridViewCell *view = nil;
+    
+    for (GMGridViewCell *v in [self itemSubviews]) 
+    {
+        if ([self itemIndexForPosition:[self positionForItemSubview:v]] == index) 
+        {
+            view = v;
+            break;
+        }
+    }
+    
+    return view;
+}
+
 - (NSInteger)positionForItemSubview:(GMGridViewCell *)view
 {
     return view.tag >= kTagOffset ? view.tag - kTagOffset : GMGV_INVALID_POSITION;
@@ -1268,6 +1347,12 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     [self.layoutStrategy setupItemSize:_itemSize andItemSpacing:self.itemSpacing withMinEdgeInsets:self.minEdgeInsets andCenteredGrid:self.centerGrid];
     [self.layoutStrategy rebaseWithItemCount:_numberTotalItems insideOfBounds:self.bounds];
     
+    // In a content window, rebasing (i.e. on rotation) can change the item shown at a position
+    if ([self layoutUsesContentWindow] && [self.layoutStrategy respondsToSelector:@selector(rebaseChangedItemIndexes)] && [self.layoutStrategy rebaseChangedItemIndexes]) 
+    {
+        [self recycleLoadedItems];
+    }
+    
     CGSize contentSize = [self.layoutStrategy contentSize];
     
     _minPossibleContentOffset = CGPointMake(0, 0);
@@ -1371,6 +1456,105 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     return targetRect;
 }
 
+//////////////////////////////////////////////////////////////
+#pragma mark Content window
+//////////////////////////////////////////////////////////////
+
+- (BOOL)layoutUsesContentWindow
+{
+    return [self.layoutStrategy respondsToSelector:@selector(usesContentWindow)] && [self.layoutStrategy usesContentWindow];
+}
+
+- (NSInteger)itemIndexForPosition:(NSInteger)position
+{
+    if ([self layoutUsesContentWindow]) 
+    {
+        return [self.layoutStrategy itemIndexForPosition:position];
+    }
+    
+    return (position >= 0 && position < _numberTotalItems) ? position : GMGV_INVALID_POSITION;
+}
+
+- (void)recenterContentWindowIfNeeded
+{
+    if (![self layoutUsesContentWindow]) 
+    {
+        return;
+    }
+    
+    // Moving the offset while paging or animating would make the grid land on the wrong place. The end of
+    // these (last layout of a deceleration, end of the drag, animation completions) tries again.
+    BOOL isPaging = self.pagingEnabled && (self.isDragging || self.isDecelerating);
+    
+    if (isPaging || _scrollAnimationActive || _sortMovingItem || [self isInTransformingState]) 
+    {
+        return;
+    }
+    
+    NSInteger positionShift = 0;
+    CGPoint offsetShift = CGPointZero;
+    
+    if ([self.layoutStrategy recenterContentWindowFromOffset:self.contentOffset positionShift:&positionShift offsetShift:&offsetShift]) 
+    {
+        [self shiftContentWindowByPositions:positionShift offset:offsetShift];
+        [self loadRequiredItems];
+    }
+}
+
+- (void)scrollPanGestureUpdated:(UIPanGestureRecognizer *)panGesture
+{
+    // A drag ending without deceleration doesn't move the offset anymore, so no layout would recenter
+    if (panGesture.state == UIGestureRecognizerStateEnded || panGesture.state == UIGestureRecognizerStateCancelled) 
+    {
+        [self recenterContentWindowIfNeeded];
+    }
+}
+
+- (void)shiftContentWindowByPositions:(NSInteger)positionShift offset:(CGPoint)offsetShift
+{
+    __block NSInteger firstPosition = GMGV_INVALID_POSITION;
+    __block NSInteger lastPosition  = GMGV_INVALID_POSITION;
+    
+    [self applyWithoutAnimation:^{
+        for (GMGridViewCell *cell in [self itemSubviews]) 
+        {
+            NSInteger position = [self positionForItemSubview:cell];
+            
+            if (position == GMGV_INVALID_POSITION) 
+            {
+                continue;
+            }
+            
+            position -= positionShift;
+            
+            // Dropping the cells that fell out of either side of the window
+            if (position < 0 || [self itemIndexForPosition:position] == GMGV_INVALID_POSITION) 
+            {
+                [self queueReusableCell:cell];
+                [cell removeFromSuperview];
+            }
+            else
+            {
+                cell.tag = position + kTagOffset;
+                cell.center = CGPointMake(cell.center.x - offsetShift.x, 
+                                          cell.center.y - offsetShift.y);
+                
+                firstPosition = firstPosition == GMGV_INVALID_POSITION ? position : MIN(firstPosition, position);
+                lastPosition  = MAX(lastPosition, position + 1);
+            }
+        }
+        
+        self.contentOffset = CGPointMake(self.contentOffset.x - offsetShift.x, 
+                                         self.contentOffset.y - offsetShift.y);
+    }];
+    
+    // Taken from the remaining cells, so that cleaning up never walks the whole shift
+    self.firstPositionLoaded = firstPosition;
+    self.lastPositionLoaded  = lastPosition;
+    
+    [self setSubviewsCacheAsInvalid];
+}
+
 //////////////////////////////////////////////////////////////
 #pragma mark loading/destroying items & reusing cells
 //////////////////////////////////////////////////////////////
@@ -1395,9 +1579,9 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     {
         positionToLoad = i + rangeOfPositions.location;
         
-        if ((forceLoad || !NSLocationInRange(positionToLoad, loadedPositionsRange)) && positionToLoad < _numberTotalItems) 
+        if ((forceLoad || !NSLocationInRange(positionToLoad, loadedPositionsRange)) && [self itemIndexForPosition:positionToLoad] != GMGV_INVALID_POSITION) 
         {
-            if (![self cellForItemAtIndex:positionToLoad]) 
+            if (![self cellForItemAtPosition:positionToLoad]) 
             {
                 GMGridViewCell *cell = [self newItemSubViewForPosition:positionToLoad];
                 [self addSubview:cell];
@@ -1416,7 +1600,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     {
         for (NSInteger i = self.firstPositionLoaded; i < (NSInteger)rangeOfPositions.location; i++) 
         {
-            cell = [self cellForItemAtIndex:i];
+            cell = [self cellForItemAtPosition:i];
             if(cell)
             {
                 [self queueReusableCell:cell];
@@ -1432,7 +1616,7 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     {
         for (NSInteger i = NSMaxRange(rangeOfPositions); i <= self.lastPositionLoaded; i++)
         {
-            cell = [self cellForItemAtIndex:i];
+            cell = [self cellForItemAtPosition:i];
             if(cell)
             {
                 [self queueReusableCell:cell];
@@ -1445,6 +1629,29 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     }
 }
 
+- (void)recycleLoadedItems
+{
+    for (GMGridViewCell *cell in [self itemSubviews]) 
+    {
+        if (cell != _transformingItem) 
+        {
+            [cell removeFromSuperview];
+            [self queueReusableCell:cell];
+        }
+    }
+    
+    self.firstPositionLoaded = GMGV_INVALID_POSITION;
+    self.lastPositionLoaded  = GMGV_INVALID_POSITION;
+    
+    [self setSubviewsCacheAsInvalid];
+}
+
+- (void)reloadLoadedItems
+{
+    [self recycleLoadedItems];
+    [self layoutSubviewsWithAnimation:GMGridViewItemAnimationNone];
+}
+
 - (void)queueReusableCell:(GMGridViewCell *)cell
 {
     if (cell) 
@@ -1537,7 +1744,14 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 {    
     NSAssert((index >= 0 && index < _numberTotalItems), @"Invalid index");
     
-    UIView *currentView = [self cellForItemAtIndex:index];
+    // Items can be shown at any position of a content window (and even at several of them)
+    if ([self layoutUsesContentWindow]) 
+    {
+        [self reloadLoadedItems];
+        return;
+    }
+    
+    UIView *currentView = [self cellForItemAtPosition:index];
     
     GMGridViewCell *cell = [self newItemSubViewForPosition:index];
     CGPoint origin = [self.layoutStrategy originForItemAtPosition:index];
@@ -1571,6 +1785,21 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     index = MAX(0, index);
     index = MIN(index, _numberTotalItems);
     
+    if ([self layoutUsesContentWindow] && [self.layoutStrategy respondsToSelector:@selector(positionForItemIndex:positionShift:offsetShift:)]) 
+    {
+        NSInteger positionShift = 0;
+        CGPoint offsetShift = CGPointZero;
+        
+        index = [self.layoutStrategy positionForItemIndex:index positionShift:&positionShift offsetShift:&offsetShift];
+        
+        // The window moved away from the loaded cells; jumping straight to the item
+        if (positionShift != 0) 
+        {
+            [self recycleLoadedItems];
+            animated = NO;
+        }
+    }
+    
     CGPoint origin = [self.layoutStrategy originForItemAtPosition:index];
     CGRect targetRect = [self rectForPoint:origin inPaggingMode:self.pagingEnabled];
     
@@ -1599,6 +1828,9 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
         }
     }
     
+    // Keeping the content window still until the animation is over
+    _scrollAnimationActive = animated && [self layoutUsesContentWindow];
+    
     // Better performance animating ourselves instead of using animated:YES in scrollRectToVisible
     [UIView animateWithDuration:animated ? kDefaultAnimationDuration : 0
                           delay:0
@@ -1607,6 +1839,11 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
                          [self scrollRectToVisible:targetRect animated:NO];
                      } 
                      completion:^(BOOL finished){
+                         if (_scrollAnimationActive) 
+                         {
+                             _scrollAnimationActive = NO;
+                             [self recenterContentWindowIfNeeded];
+                         }
                      }
      ];
 }
@@ -1620,15 +1857,28 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 {
     NSAssert((index >= 0 && index <= _numberTotalItems), @"Invalid index specified");
     
+    if ([self layoutUsesContentWindow]) 
+    {
+        _numberTotalItems++;
+        [self reloadLoadedItems];
+        
+        if (animation & GMGridViewItemAnimationScroll) 
+        {
+            [self scrollToObjectAtIndex:index atScrollPosition:GMGridViewScrollPositionNone animated:YES];
+        }
+        
+        return;
+    }
+    
     GMGridViewCell *cell = nil;
     
     if (index >= self.firstPositionLoaded && index <= self.lastPositionLoaded) 
     {        
         cell = [self newItemSubViewForPosition:index];
         
-        for (int i = _numberTotalItems - 1; i >= index; i--)
+        for (NSInteger i = _numberTotalItems - 1; i >= index; i--)
         {
-            UIView *oldView = [self cellForItemAtIndex:i];
+            UIView *oldView = [self cellForItemAtPosition:i];
             oldView.tag = oldView.tag + 1;
         }
         
@@ -1677,11 +1927,24 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
 {
     NSAssert((index >= 0 && index < _numberTotalItems), @"Invalid index specified");
     
-    GMGridViewCell *cell = [self cellForItemAtIndex:index];
+    if ([self layoutUsesContentWindow]) 
+    {
+        _numberTotalItems--;
+        [self reloadLoadedItems];
+        
+        if (animation & GMGridViewItemAnimationScroll) 
+        {
+            [self scrollToObjectAtIndex:index atScrollPosition:GMGridViewScrollPositionNone animated:YES];
+        }
+        
+        return;
+    }
+    
+    GMGridViewCell *cell = [self cellForItemAtPosition:index];
     
-    for (int i = index + 1; i < _numberTotalItems; i++)
+    for (NSInteger i = index + 1; i < _numberTotalItems; i++)
     {
-        GMGridViewCell *oldView = [self cellForItemAtIndex:i];
+        GMGridViewCell *oldView = [self cellForItemAtPosition:i];
         oldView.tag = oldView.tag - 1;
     }
     
@@ -1726,8 +1989,14 @@ static const UIViewAnimationOptions kDefaultAnimationOptions = UIViewAnimationOp
     NSAssert((index1 >= 0 && index1 < _numberTotalItems), @"Invalid index1 specified");
     NSAssert((index2 >= 0 && index2 < _numberTotalItems), @"Invalid index2 specified");
     
-    GMGridViewCell *view1 = [self cellForItemAtIndex:index1];
-    GMGridViewCell *view2 = [self cellForItemAtIndex:index2];
+    if ([self layoutUsesContentWindow]) 
+    {
+        [self reloadLoadedItems];
+        return;
+    }
+    
+    GMGridViewCell *view1 = [self cellForItemAtPosition:index1];
+    GMGridViewCell *view2 = [self cellForItemAtPosition:index2];
     
     view1.tag = index2 + kTagOffset;
     view2.tag = index1 + kTagOffset;
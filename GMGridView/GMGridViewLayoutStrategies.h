@@ -76,6 +76,21 @@ typedef enum {
 
 - (NSRange)rangeOfPositionsInBoundsFromOffset:(CGPoint)offset;
 
+@optional
+// Content window - strategies returning YES lay items out in a bounded window of positions
+// that does not match the datasource indexes; the grid maps every position before using it.
+// Sorting is disabled in that case and the item actions of the grid reload its loaded cells.
+- (BOOL)usesContentWindow;
+- (NSInteger)itemIndexForPosition:(NSInteger)position; // GMGV_INVALID_POSITION for empty slots
+- (BOOL)rebaseChangedItemIndexes;                      // YES if the last rebase changed the item shown at some position (i.e. on rotation)
+
+// Moves the window when the offset gets away from its center. Returns YES if it moved; the loaded
+// positions and the content offset must then be reduced by positionShift and offsetShift
+- (BOOL)recenterContentWindowFromOffset:(CGPoint)offset positionShift:(NSInteger *)positionShift offsetShift:(CGPoint *)offsetShift;
+
+// Position showing the item at index, moving the window around it first if needed (same shifts as above)
+- (NSInteger)positionForItemIndex:(NSInteger)index positionShift:(NSInteger *)positionShift offsetShift:(CGPoint *)offsetShift;
+
 @end
 
 
@@ -100,6 +115,7 @@ typedef enum {
     UIEdgeInsets _edgeInsets;
     CGRect _gridBounds;
     CGSize _contentSize;
+    BOOL _rebaseChangedItemIndexes;
 }
 
 @property (nonatomic, readonly) GMGridViewLayoutStrategyType type;
@@ -113,6 +129,7 @@ typedef enum {
 @property (nonatomic, readonly) UIEdgeInsets edgeInsets;
 @property (nonatomic, readonly) CGRect gridBounds;
 @property (nonatomic, readonly) CGSize contentSize;
+@property (nonatomic, readonly) BOOL rebaseChangedItemIndexes;
 
 // Protocol methods implemented in base class
 - (void)setupItemSize:(CGSize)itemSize andItemSpacing:(NSInteger)spacing withMinEdgeInsets:(UIEdgeInsets)edgeInsets andCenteredGrid:(BOOL)centered;
@@ -130,10 +147,24 @@ typedef enum {
 {
     @protected
     NSInteger _numberOfItemsPerRow;
+    
+    BOOL _virtualized;
+    int64_t _numberOfRows;
+    NSInteger _numberOfVisibleRows;
+    NSInteger _numberOfWindowRows;
+    int64_t _windowFirstItem;
+    int64_t _windowFirstRow;
 }
 
 @property (nonatomic, readonly) NSInteger numberOfItemsPerRow;
 
+// Set before assigning the strategy to the grid; assign it again to apply later changes
+@property (nonatomic) BOOL virtualized;                 // Default is NO - When set to YES, only a bounded window of rows is given to the scrollView and its origin is rebased while scrolling
+@property (nonatomic, readonly) NSInteger numberOfWindowRows;
+@property (nonatomic, readonly) int64_t windowFirstRow; // Row shown at the top of the content window - add it to the rows of the content offset to get absolute rows
+// The scroll indicators of the grid are hidden since they would be relative to the window; scrubbers should
+// call scrollToObjectAtIndex: on the grid, which moves the window around the item
+
 @end
 
 //////////////////////////////////////////////////////////////
@@ -161,12 +192,22 @@ typedef enum {
     NSInteger _numberOfItemsPerRow;
     NSInteger _numberOfItemsPerPage;
     NSInteger _numberOfPages;
+    
+    BOOL _circular;
+    NSInteger _numberOfRetainedPages;
+    NSInteger _numberOfWindowPages;
+    NSInteger _windowFirstPage;
 }
 
 @property (nonatomic, readonly) NSInteger numberOfItemsPerRow;
 @property (nonatomic, readonly) NSInteger numberOfItemsPerPage;
 @property (nonatomic, readonly) NSInteger numberOfPages;
 
+// Set these before assigning the strategy to the grid; assign it again to apply later changes
+@property (nonatomic) BOOL circular;                    // Default is NO - When set to YES, the pages wrap around in a small content window recentered while paging
+@property (nonatomic) NSInteger numberOfRetainedPages;  // Default is 1 (minimum) - Pages kept loaded on each side of the current page
+@property (nonatomic, readonly) NSInteger numberOfWindowPages;
+
 
 // Only these 3 methods have be reimplemented by child classes to change the LTR and TTB kind of behavior
 - (NSInteger)positionForItemAtColumn:(NSInteger)column row:(NSInteger)row page:(NSInteger)page;
@@ -28,6 +28,12 @@
 
 #import "GMGridViewLayoutStrategies.h"
 
+// Extra pages on each side of the retained ones, so that a few quick swipes don't hit the window edges
+static const NSInteger kCircularWindowPaddingPages = 2;
+
+// Height of the virtualized content window, in screens
+static const NSInteger kVirtualizedWindowScreens = 16;
+
 //////////////////////////////////////////////////////////////
 #pragma mark - 
 #pragma mark - Factory implementation
@@ -79,6 +85,7 @@
 @synthesize edgeInsets    = _edgeInsets;
 @synthesize gridBounds    = _gridBounds;
 @synthesize contentSize   = _contentSize;
+@synthesize rebaseChangedItemIndexes = _rebaseChangedItemIndexes;
 
 
 - (void)setupItemSize:(CGSize)itemSize andItemSpacing:(NSInteger)spacing withMinEdgeInsets:(UIEdgeInsets)edgeInsets andCenteredGrid:(BOOL)centered
@@ -127,6 +134,9 @@
 @implementation GMGridViewLayoutVerticalStrategy
 
 @synthesize numberOfItemsPerRow = _numberOfItemsPerRow;
+@synthesize virtualized         = _virtualized;
+@synthesize numberOfWindowRows  = _numberOfWindowRows;
+@synthesize windowFirstRow      = _windowFirstRow;
 
 + (BOOL)requiresEnablingPaging
 {
@@ -138,6 +148,9 @@
     if ((self = [super init])) 
     {
         _type = GMGridViewLayoutVertical;
+        _virtualized = NO;
+        _windowFirstItem = 0;
+        _windowFirstRow = 0;
     }
     
     return self;
@@ -145,6 +158,9 @@
 
 - (void)rebaseWithItemCount:(NSInteger)count insideOfBounds:(CGRect)bounds
 {
+    NSInteger previousNumberOfItemsPerRow = _numberOfItemsPerRow;
+    int64_t previousWindowFirstRow = _windowFirstRow;
+    
     _itemCount  = count;
     _gridBounds = bounds;
     
@@ -160,10 +176,35 @@
         _numberOfItemsPerRow++;
     }
     
-    NSInteger numberOfRows = ceil(self.itemCount / (1.0 * self.numberOfItemsPerRow));
+    _numberOfRows = ((int64_t)self.itemCount + self.numberOfItemsPerRow - 1) / self.numberOfItemsPerRow;
+    
+    CGFloat itemHeight = self.itemSize.height + self.itemSpacing;
+    _numberOfVisibleRows = itemHeight > 0 ? ceil(bounds.size.height / itemHeight) + 1 : 1;
+    
+    if (self.virtualized) 
+    {
+        _numberOfWindowRows = (NSInteger)MIN(_numberOfRows, (int64_t)_numberOfVisibleRows * kVirtualizedWindowScreens);
+        // The window is anchored on an item, so that it stays in the first row when the number of items per row changes
+        int64_t firstRow = MAX(0, MIN(_windowFirstItem / self.numberOfItemsPerRow, _numberOfRows - _numberOfWindowRows));
+        
+        if (firstRow != _windowFirstItem / self.numberOfItemsPerRow) 
+        {
+            _windowFirstItem = firstRow * self.numberOfItemsPerRow;
+        }
+        
+        _windowFirstRow = firstRow;
+    }
+    else
+    {
+        _numberOfWindowRows = (NSInteger)_numberOfRows;
+        _windowFirstItem = 0;
+        _windowFirstRow = 0;
+    }
+    
+    _rebaseChangedItemIndexes = (self.numberOfItemsPerRow != previousNumberOfItemsPerRow || self.windowFirstRow != previousWindowFirstRow);
     
     CGSize actualContentSize = CGSizeMake(ceil(MIN(self.itemCount, self.numberOfItemsPerRow) * (self.itemSize.width + self.itemSpacing)) - self.itemSpacing, 
-                               ceil(numberOfRows * (self.itemSize.height + self.itemSpacing)) - self.itemSpacing);
+                               ceil(self.numberOfWindowRows * itemHeight) - self.itemSpacing);
     
     [self setEdgeAndContentSizeFromAbsoluteContentSize:actualContentSize];
 }
@@ -189,12 +230,12 @@
     CGPoint relativeLocation = CGPointMake(location.x - self.edgeInsets.left,
                                            location.y - self.edgeInsets.top);
     
-    int col = (int) (relativeLocation.x / (self.itemSize.width + self.itemSpacing)); 
-    int row = (int) (relativeLocation.y / (self.itemSize.height + self.itemSpacing));
+    NSInteger col = (NSInteger) (relativeLocation.x / (self.itemSize.width + self.itemSpacing)); 
+    NSInteger row = (NSInteger) (relativeLocation.y / (self.itemSize.height + self.itemSpacing));
     
-    int position = col + row * self.numberOfItemsPerRow;
+    NSInteger position = col + row * self.numberOfItemsPerRow;
     
-    if (position >= [self itemCount] || position < 0) 
+    if ([self itemIndexForPosition:position] == GMGV_INVALID_POSITION) 
     {
         position = GMGV_INVALID_POSITION;
     }
@@ -222,9 +263,9 @@
     
     CGFloat itemHeight = self.itemSize.height + self.itemSpacing;
     
-    CGFloat firstRow = MAX(0, (int)(contentOffset.y / itemHeight) - 1);
+    NSInteger firstRow = MAX(0, (NSInteger)(contentOffset.y / itemHeight) - 1);
 
-    CGFloat lastRow = ceil((contentOffset.y + self.gridBounds.size.height) / itemHeight);
+    NSInteger lastRow = ceil((contentOffset.y + self.gridBounds.size.height) / itemHeight);
     
     NSInteger firstPosition = firstRow * self.numberOfItemsPerRow;
     NSInteger lastPosition  = ((lastRow + 1) * self.numberOfItemsPerRow);
@@ -232,6 +273,79 @@
     return NSMakeRange(firstPosition, (lastPosition - firstPosition));
 }
 
+- (BOOL)usesContentWindow
+{
+    return self.virtualized;
+}
+
+- (NSInteger)itemIndexForPosition:(NSInteger)position
+{
+    if (position < 0 || position >= (int64_t)self.numberOfWindowRows * self.numberOfItemsPerRow) 
+    {
+        return GMGV_INVALID_POSITION;
+    }
+    
+    int64_t index = self.windowFirstRow * self.numberOfItemsPerRow + position;
+    
+    return index < self.itemCount ? (NSInteger)index : GMGV_INVALID_POSITION;
+}
+
+- (BOOL)moveContentWindowToFirstRow:(int64_t)firstRow positionShift:(NSInteger *)positionShift offsetShift:(CGPoint *)offsetShift
+{
+    firstRow = MAX(0, MIN(firstRow, _numberOfRows - self.numberOfWindowRows));
+    
+    int64_t rowShift = firstRow - _windowFirstRow;
+    
+    if (rowShift == 0) 
+    {
+        return NO;
+    }
+    
+    _windowFirstItem = firstRow * self.numberOfItemsPerRow;
+    _windowFirstRow = firstRow;
+    
+    *positionShift = (NSInteger)(rowShift * self.numberOfItemsPerRow);
+    *offsetShift   = CGPointMake(0, rowShift * (self.itemSize.height + self.itemSpacing));
+    
+    return YES;
+}
+
+- (BOOL)recenterContentWindowFromOffset:(CGPoint)offset positionShift:(NSInteger *)positionShift offsetShift:(CGPoint *)offsetShift
+{
+    CGFloat itemHeight = self.itemSize.height + self.itemSpacing;
+    
+    if (!self.virtualized || self.numberOfWindowRows >= _numberOfRows || itemHeight <= 0) 
+    {
+        return NO;
+    }
+    
+    NSInteger topRow = floor(MAX(0, offset.y - self.edgeInsets.top) / itemHeight);
+    NSInteger margin = self.numberOfWindowRows / 4;
+    
+    // Only rebasing once the visible rows get close to the window edges
+    if (topRow >= margin && topRow + _numberOfVisibleRows <= self.numberOfWindowRows - margin) 
+    {
+        return NO;
+    }
+    
+    int64_t firstRow = self.windowFirstRow + topRow - (self.numberOfWindowRows - _numberOfVisibleRows) / 2;
+    
+    return [self moveContentWindowToFirstRow:firstRow positionShift:positionShift offsetShift:offsetShift];
+}
+
+- (NSInteger)positionForItemIndex:(NSInteger)index positionShift:(NSInteger *)positionShift offsetShift:(CGPoint *)offsetShift
+{
+    int64_t row = index / self.numberOfItemsPerRow;
+    
+    if (row < self.windowFirstRow || row >= self.windowFirstRow + self.numberOfWindowRows) 
+    {
+        int64_t firstRow = row - (self.numberOfWindowRows - _numberOfVisibleRows) / 2;
+        [self moveContentWindowToFirstRow:firstRow positionShift:positionShift offsetShift:offsetShift];
+    }
+    
+    return (NSInteger)(index - self.windowFirstRow * self.numberOfItemsPerRow);
+}
+
 @end
 
 
@@ -305,10 +419,10 @@
     CGPoint relativeLocation = CGPointMake(location.x - self.edgeInsets.left,
                                            location.y - self.edgeInsets.top);
 
-    int col = (int) (relativeLocation.x / (self.itemSize.width + self.itemSpacing)); 
-    int row = (int) (relativeLocation.y / (self.itemSize.height + self.itemSpacing));
+    NSInteger col = (NSInteger) (relativeLocation.x / (self.itemSize.width + self.itemSpacing)); 
+    NSInteger row = (NSInteger) (relativeLocation.y / (self.itemSize.height + self.itemSpacing));
     
-    int position = row + col * self.numberOfItemsPerColumn;
+    NSInteger position = row + col * self.numberOfItemsPerColumn;
     
     if (position >= [self itemCount] || position < 0) 
     {
@@ -338,9 +452,9 @@
     
     CGFloat itemWidth = self.itemSize.width + self.itemSpacing;
     
-    CGFloat firstCol = MAX(0, (int)(contentOffset.x / itemWidth) - 1);
+    NSInteger firstCol = MAX(0, (NSInteger)(contentOffset.x / itemWidth) - 1);
     
-    CGFloat lastCol = ceil((contentOffset.x + self.gridBounds.size.width) / itemWidth);
+    NSInteger lastCol = ceil((contentOffset.x + self.gridBounds.size.width) / itemWidth);
     
     NSInteger firstPosition = firstCol * self.numberOfItemsPerColumn;
     NSInteger lastPosition  = ((lastCol + 1) * self.numberOfItemsPerColumn);
@@ -362,14 +476,38 @@
 @synthesize numberOfItemsPerPage = _numberOfItemsPerPage;
 @synthesize numberOfItemsPerRow  = _numberOfItemsPerRow;
 @synthesize numberOfPages        = _numberOfPages;
+@synthesize circular              = _circular;
+@synthesize numberOfRetainedPages = _numberOfRetainedPages;
+@synthesize numberOfWindowPages   = _numberOfWindowPages;
 
 + (BOOL)requiresEnablingPaging
 {
     return YES;
 }
 
+- (id)init
+{
+    if ((self = [super init])) 
+    {
+        _circular = NO;
+        _numberOfRetainedPages = 1;
+        _windowFirstPage = 0;
+    }
+    
+    return self;
+}
+
+- (void)setNumberOfRetainedPages:(NSInteger)numberOfRetainedPages
+{
+    // Less than one page on each side would leave the page swiping in blank until it's reached
+    _numberOfRetainedPages = MAX(1, numberOfRetainedPages);
+}
+
 - (void)rebaseWithItemCount:(NSInteger)count insideOfBounds:(CGRect)bounds
 {
+    NSInteger previousNumberOfItemsPerPage = _numberOfItemsPerPage;
+    NSInteger previousNumberOfPages = _numberOfPages;
+    
     [super rebaseWithItemCount:count insideOfBounds:bounds];
     
     _numberOfItemsPerRow = 1;
@@ -407,7 +545,18 @@
         _edgeInsets = self.minEdgeInsets;
     }
     
-    _contentSize = CGSizeMake(bounds.size.width * self.numberOfPages, 
+    if (self.circular && self.numberOfPages > 0)
+    {
+        _numberOfWindowPages = 2 * (self.numberOfRetainedPages + kCircularWindowPaddingPages) + 1;
+    }
+    else
+    {
+        _numberOfWindowPages = self.numberOfPages;
+    }
+    
+    _rebaseChangedItemIndexes = (self.numberOfItemsPerPage != previousNumberOfItemsPerPage || self.numberOfPages != previousNumberOfPages);
+    
+    _contentSize = CGSizeMake(bounds.size.width * self.numberOfWindowPages, 
                               bounds.size.height);
 }
 
@@ -472,12 +621,12 @@
     CGPoint relativeLocation = CGPointMake(location.x - originForFirstItemInPage.x,
                                            location.y - originForFirstItemInPage.y);
 
-    int col = (int) (relativeLocation.x / (self.itemSize.width + self.itemSpacing)); 
-    int row = (int) (relativeLocation.y / (self.itemSize.height + self.itemSpacing));
+    NSInteger col = (NSInteger) (relativeLocation.x / (self.itemSize.width + self.itemSpacing)); 
+    NSInteger row = (NSInteger) (relativeLocation.y / (self.itemSize.height + self.itemSpacing));
     
-    int position = [self positionForItemAtColumn:col row:row page:page];
+    NSInteger position = [self positionForItemAtColumn:col row:row page:page];
  
-    if (position >= [self itemCount] || position < 0) 
+    if ([self itemIndexForPosition:position] == GMGV_INVALID_POSITION) 
     {
         position = GMGV_INVALID_POSITION;
     }
@@ -505,10 +654,105 @@
     
     NSInteger page = floor(contentOffset.x / self.gridBounds.size.width);
     
-    NSInteger firstPosition = MAX(0, (page - 1) * self.numberOfItemsPerPage);
-    NSInteger lastPosition  = MIN(firstPosition + 3 * self.numberOfItemsPerPage, self.itemCount);
+    NSInteger maxPosition = self.circular ? self.numberOfWindowPages * self.numberOfItemsPerPage : self.itemCount;
     
-    return NSMakeRange(firstPosition, (lastPosition - firstPosition));
+    NSInteger firstPosition = MAX(0, (page - self.numberOfRetainedPages) * self.numberOfItemsPerPage);
+    NSInteger lastPosition  = MIN(firstPosition + (2 * self.numberOfRetainedPages + 1) * self.numberOfItemsPerPage, maxPosition);
+    
+    return NSMakeRange(firstPosition, MAX(0, lastPosition - firstPosition));
+}
+
+- (BOOL)usesContentWindow
+{
+    return self.circular;
+}
+
+- (NSInteger)itemIndexForPosition:(NSInteger)position
+{
+    if (!self.circular) 
+    {
+        return (position >= 0 && position < self.itemCount) ? position : GMGV_INVALID_POSITION;
+    }
+    
+    if (position < 0 || self.numberOfPages == 0 || position >= self.numberOfWindowPages * self.numberOfItemsPerPage) 
+    {
+        return GMGV_INVALID_POSITION;
+    }
+    
+    // The window pages wrap around the real pages, the slot within a page is kept as is
+    NSInteger page = (_windowFirstPage + position / self.numberOfItemsPerPage) % self.numberOfPages;
+    
+    if (page < 0) 
+    {
+        page += self.numberOfPages;
+    }
+    
+    NSInteger index = page * self.numberOfItemsPerPage + position % self.numberOfItemsPerPage;
+    
+    return index < self.itemCount ? index : GMGV_INVALID_POSITION;
+}
+
+- (BOOL)recenterContentWindowFromOffset:(CGPoint)offset positionShift:(NSInteger *)positionShift offsetShift:(CGPoint *)offsetShift
+{
+    if (!self.circular || self.numberOfPages == 0 || self.gridBounds.size.width <= 0) 
+    {
+        return NO;
+    }
+    
+    NSInteger page = floor(offset.x / self.gridBounds.size.width);
+    page = MAX(0, MIN(page, self.numberOfWindowPages - 1));
+    
+    NSInteger pageShift = page - self.numberOfWindowPages / 2;
+    
+    if (pageShift == 0) 
+    {
+        return NO;
+    }
+    
+    // Keeping the window first page small so that it never overflows while paging forever
+    _windowFirstPage = (_windowFirstPage + pageShift) % self.numberOfPages;
+    
+    *positionShift = pageShift * self.numberOfItemsPerPage;
+    *offsetShift   = CGPointMake(pageShift * self.gridBounds.size.width, 0);
+    
+    return YES;
+}
+
+- (NSInteger)positionForItemIndex:(NSInteger)index positionShift:(NSInteger *)positionShift offsetShift:(CGPoint *)offsetShift
+{
+    if (!self.circular || self.numberOfPages == 0) 
+    {
+        return index;
+    }
+    
+    // Picking the window page showing the item that is the closest to the center of the window
+    NSInteger centerPage = self.numberOfWindowPages / 2;
+    NSInteger pageDelta = ([self pageForItemAtIndex:index] - (_windowFirstPage + centerPage)) % self.numberOfPages;
+    
+    if (pageDelta < 0) 
+    {
+        pageDelta += self.numberOfPages;
+    }
+    
+    if (pageDelta > self.numberOfPages / 2) 
+    {
+        pageDelta -= self.numberOfPages;
+    }
+    
+    NSInteger windowPage = centerPage + pageDelta;
+    
+    // Too far from the center, moving the window so that the item's page becomes its center
+    if (windowPage < 0 || windowPage >= self.numberOfWindowPages) 
+    {
+        _windowFirstPage = (_windowFirstPage + pageDelta) % self.numberOfPages;
+        
+        *positionShift = pageDelta * self.numberOfItemsPerPage;
+        *offsetShift   = CGPointMake(pageDelta * self.gridBounds.size.width, 0);
+        
+        windowPage = centerPage;
+    }
+    
+    return windowPage * self.numberOfItemsPerPage + index % self.numberOfItemsPerPage;
 }
 
 @end